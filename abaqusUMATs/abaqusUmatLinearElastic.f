@@ -9,19 +9,20 @@
       INCLUDE 'ABA_PARAM.INC'
 
 !     Declare input/output variables
-!     Take care: unused variables here are set to doubles
-      real*8, INTENT(OUT) :: STRESS(NTENS)
-      real*8, INTENT(OUT) :: STATEV(NSTATV)
+!     The tensors are in Voigt notation ordered as 11, 22, 33, 12, 13,
+!     23 with engineering shear strains
+      CHARACTER*80 CMNAME
+      integer, INTENT(IN) :: NDI,NSHR,NTENS,NSTATV,NPROPS
+      integer, INTENT(IN) :: NOEL,NPT,LAYER,KSPT,JSTEP(4),KINC
+      real*8, INTENT(INOUT) :: STRESS(NTENS)
+      real*8, INTENT(INOUT) :: STATEV(*)
       real*8, INTENT(OUT) :: DDSDDE(NTENS,NTENS)
-      real*8, INTENT(IN) :: SSE,SPD,SCD, RPL,DDSDDT,DRPLDE,DRPLDT
-      real*8, INTENT(IN)  ::  STRAN(NTENS), DSTRAN(NTENS)
-      real*8, INTENT(IN) :: TIME,DTIME,TEMP,DTEMP,PREDEF,DPRED,
-     1    CMNAME
-      integer, INTENT(IN) :: NDI,NSHR,NTENS,NSTATV
-      real*8, INTENT(IN) :: PROPS(NPROPS)
-      integer, INTENT(IN) :: NPROPS
-      real*8, INTENT(IN) :: COORDS,DROT,PNEWDT, CELENT,DFGRD0,DFGRD1,
-     1    NOEL,NPT,LAYER,KSPT,JSTEP,KINC
+      real*8, INTENT(INOUT) :: SSE,SPD,SCD,RPL,PNEWDT
+      real*8, INTENT(INOUT) :: DDSDDT(NTENS),DRPLDE(NTENS),DRPLDT
+      real*8, INTENT(IN) :: STRAN(NTENS),DSTRAN(NTENS)
+      real*8, INTENT(IN) :: TIME(2),DTIME,TEMP,DTEMP,PREDEF(*),DPRED(*)
+      real*8, INTENT(IN) :: PROPS(NPROPS),COORDS(3),DROT(3,3),CELENT
+      real*8, INTENT(IN) :: DFGRD0(3,3),DFGRD1(3,3)
 
 !     Declare local variables
       real*8 E, NU, ONE, TWO, ALAMBDA, BLAMBDA, CLAMBDA
@@ -29,7 +30,8 @@
       ONE=1.0D0
       TWO=2.0D0
 
-!     Stiffness matrix
+!     Stiffness matrix, where the shear terms multiply the engineering
+!     shear strains
       E=PROPS(1)
       NU=PROPS(2)
       ALAMBDA=E/(ONE+nu)/(ONE-TWO*nu)
@@ -43,9 +45,9 @@
       DDSDDE(1,1)=(ALAMBDA*BLAMBDA)
       DDSDDE(2,2)=(ALAMBDA*BLAMBDA)
       DDSDDE(3,3)=(ALAMBDA*BLAMBDA)
-      DDSDDE(4,4)=(ALAMBDA*CLAMBDA)
-      DDSDDE(5,5)=(ALAMBDA*CLAMBDA)
-      DDSDDE(6,6)=(ALAMBDA*CLAMBDA)
+      DDSDDE(4,4)=(ALAMBDA*CLAMBDA)/TWO
+      DDSDDE(5,5)=(ALAMBDA*CLAMBDA)/TWO
+      DDSDDE(6,6)=(ALAMBDA*CLAMBDA)/TWO
       DDSDDE(1,2)=(ALAMBDA*nu)
       DDSDDE(1,3)=(ALAMBDA*nu)
       DDSDDE(2,3)=(ALAMBDA*nu)
@@ -53,10 +55,10 @@
       DDSDDE(3,1)=(ALAMBDA*nu)
       DDSDDE(3,2)=(ALAMBDA*nu)
 
-!     Calculate stress
+!     Update stress from the stress at the start of the increment
       DO I=1,NTENS
          DO J=1,NTENS
-            STRESS(I)=STRESS(I)+DDSDDE(I,J)*STRAN(J)
+            STRESS(I)=STRESS(I)+DDSDDE(I,J)*DSTRAN(J)
          ENDDO
       ENDDO
 